@@ -11,6 +11,7 @@ TARGET   := bogart
 SOURCES  := bogart.C \
             AS_BAT_AssemblyGraph.C \
             AS_BAT_BestOverlapGraph.C \
+            AS_BAT_Checkpoint.C \
             AS_BAT_ChunkGraph.C \
             AS_BAT_CreateUnitigs.C \
             AS_BAT_DropDeadEnds.C \
@@ -24,6 +25,7 @@ SOURCES  := bogart.C \
             AS_BAT_PlaceContains.C \
             AS_BAT_PlaceReadUsingOverlaps.C \
             AS_BAT_PopulateUnitig.C \
+            AS_BAT_Profile.C \
             AS_BAT_PromoteToSingleton.C \
             AS_BAT_ReadInfo.C \
             AS_BAT_SetParentAndHang.C \
@@ -8,9 +8,9 @@ ifeq "$(strip ${TARGET_DIR})" ""
 endif
 
 TARGET   := filterCorrectionLayouts
-SOURCES  := filterCorrectionLayouts.C
+SOURCES  := filterCorrectionLayouts.C correctionLayouts.C ../utgcns/stashContains.C
 
-SRC_INCDIRS  := .. ../AS_UTL ../stores
+SRC_INCDIRS  := .. ../AS_UTL ../stores ../utgcns
 
 TGT_LDFLAGS := -L${TARGET_DIR}
 TGT_LDLIBS  := -lcanu
@@ -193,6 +193,7 @@ SUBMAKEFILES := stores/gatekeeperCreate.mk \
                 overlapInCore/overlapConvert.mk \
                 overlapInCore/overlapImport.mk \
                 overlapInCore/overlapPair.mk \
+                overlapInCore/edlibBenchmark.mk \
                 \
                 overlapInCore/liboverlap/prefixEditDistance-matchLimitGenerate.mk \
                 \
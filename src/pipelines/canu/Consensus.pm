@@ -62,6 +62,14 @@ sub utgcns ($$$) {
 
     my $path    = "unitigging/5-consensus";
 
+    #  Windows overlap by 10 Kbp, or by a quarter of the window for small windows, so that the
+    #  window is always larger than the overlap.
+
+    my $windowSize    = getGlobal("cnsWindowSize");
+    my $windowOverlap = (defined($windowSize)) ? int($windowSize / 4) : undef;
+
+    $windowOverlap = 10000   if (defined($windowOverlap) && ($windowOverlap > 10000));
+
     open(F, "> $path/consensus.sh") or caExit("can't open '$path/consensus.sh' for writing: $!", undef);
 
     print F "#!" . getGlobal("shell") . "\n";
@@ -104,6 +112,7 @@ sub utgcns ($$$) {
     print F "  -T ../$asm.\${tag}Store 1 \$jobid \\\n";
     print F "  -O ./\${tag}cns/\$jobid.cns.WORKING \\\n";
     print F "  -maxcoverage " . getGlobal('cnsMaxCoverage') . " \\\n";
+    print F "  -window $windowSize $windowOverlap \\\n"   if (defined($windowSize));
     print F "  -e " . getGlobal("cnsErrorRate") . " \\\n";
     print F "  -quick \\\n"      if (getGlobal("cnsConsensus") eq "quick");
     print F "  -pbdagcon \\\n"   if (getGlobal("cnsConsensus") eq "pbdagcon");
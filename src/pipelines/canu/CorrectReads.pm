@@ -78,6 +78,25 @@ sub getCorCov ($$) {
 }
 
 
+#  Returns the options that select evidence for correction layouts.  These are used by
+#  generateCorrectionLayouts, and, if corLayoutStreaming is set, by filterCorrectionLayouts
+#  and falconsense, which then build layouts from overlaps instead of loading a corStore.
+#  $scores is the path to the global scores file, relative to where the command runs.
+#
+sub getCorLayoutOptions ($$) {
+    my $asm     = shift @_;
+    my $scores  = shift @_;
+    my $opts;
+
+    $opts .= "  -S $scores \\\n"                                    if (-e "correction/2-correction/$asm.globalScores");
+    $opts .= "  -eL " . getGlobal("corMinEvidenceLength") . " \\\n"  if (defined(getGlobal("corMinEvidenceLength")));
+    $opts .= "  -eE " . getGlobal("corMaxEvidenceErate")  . " \\\n"  if (defined(getGlobal("corMaxEvidenceErate")));
+    $opts .= "  -eC " . getCorCov($asm, "Local") . " \\\n";
+
+    return($opts);
+}
+
+
 #  Query gkpStore to find the read types involved.  Return an error rate that is appropriate for
 #  aligning reads of that type to each other.
 sub getCorIdentity ($) {
@@ -252,6 +271,7 @@ sub buildCorrectionLayoutsConfigure ($) {
             $cmd .= "  -c " . getCorCov($asm, "Global") . " \\\n";
             $cmd .= "  -l " . getGlobal("corMinEvidenceLength") . " \\\n"  if (defined(getGlobal("corMinEvidenceLength")));
             $cmd .= "  -e " . getGlobal("corMaxEvidenceErate")  . " \\\n"  if (defined(getGlobal("corMaxEvidenceErate")));
+            $cmd .= "  -t " . getGlobal("corThreads") . " \\\n";
             $cmd .= "> ./$asm.globalScores.err 2>&1";
 
             if (runCommand($path, $cmd)) {
@@ -282,6 +302,13 @@ sub buildCorrectionLayoutsConfigure ($) {
         print STDERR "-- Global filter scores will be estimated.\n";
     }
 
+    #  If layouts are built on the fly, there is nothing more to do here.
+
+    if (getGlobal("corLayoutStreaming") == 1) {
+        print STDERR "-- Correction layouts will be built from overlaps when needed.\n";
+        goto finishStage;
+    }
+
     #  Make layouts for each corrected read.
 
     fetchStore("./correction/$asm.gkpStore");
@@ -293,11 +320,9 @@ sub buildCorrectionLayoutsConfigure ($) {
     $cmd .= "  -G ./$asm.gkpStore \\\n";
     $cmd .= "  -O ./$asm.ovlStore \\\n";
     $cmd .= "  -C ./$asm.corStore.WORKING \\\n";
-    $cmd .= "  -S 2-correction/$asm.globalScores \\\n"              if (-e "$path/$asm.globalScores");
-    $cmd .= "  -eL " . getGlobal("corMinEvidenceLength") . " \\\n"  if (defined(getGlobal("corMinEvidenceLength")));
-    $cmd .= "  -eE " . getGlobal("corMaxEvidenceErate")  . " \\\n"  if (defined(getGlobal("corMaxEvidenceErate")));
+    $cmd .= getCorLayoutOptions($asm, "2-correction/$asm.globalScores");
     $cmd .= "  -ec " . getGlobal("corMinCoverage") . " \\\n";
-    $cmd .= "  -eC " . getCorCov($asm, "Local") . " \\\n";
+    $cmd .= "  -t " . getGlobal("corThreads") . " \\\n";
     $cmd .= "> ./$asm.corStore.err 2>&1\n";
 
     if (runCommand($base, $cmd)) {
@@ -367,7 +392,8 @@ sub filterCorrectionLayouts ($) {
 
     $cmd  = "$bin/filterCorrectionLayouts \\\n";
     $cmd .= "  -G ../$asm.gkpStore \\\n";
-    $cmd .= "  -C ../$asm.corStore \\\n";
+    $cmd .= "  -C ../$asm.corStore \\\n"                                         if (getGlobal("corLayoutStreaming") == 0);
+    $cmd .= "  -O ../$asm.ovlStore \\\n" . getCorLayoutOptions($asm, "./$asm.globalScores")  if (getGlobal("corLayoutStreaming") == 1);
     $cmd .= "  -R ./$asm.readsToCorrect.WORKING \\\n";
     $cmd .= "  -g $genomeSize \\\n";
     $cmd .= "  -c $outCoverage \\\n";
@@ -502,7 +528,8 @@ sub generateCorrectedReadsConfigure ($) {
     print F "\n";
     print F "\$bin/falconsense \\\n";
     print F "  -G \$gkpStore \\\n";
-    print F "  -C ../$asm.corStore \\\n";
+    print F "  -C ../$asm.corStore \\\n"                                         if (getGlobal("corLayoutStreaming") == 0);
+    print F "  -O ../$asm.ovlStore \\\n" . getCorLayoutOptions($asm, "./$asm.globalScores")  if (getGlobal("corLayoutStreaming") == 1);
     print F "  -b \$bgn -e \$end -r ./$asm.readsToCorrect \\\n"     if (  -e "$path/$asm.readsToCorrect");
     print F "  -b \$bgn -e \$end \\\n"                              if (! -e "$path/$asm.readsToCorrect");
     print F "  -t  " . getGlobal("corThreads") . " \\\n";
@@ -880,6 +880,7 @@ sub setDefaults () {
     setDefault("obtErrorRate",       undef, "Stringency of overlaps to use for trimming");
     setDefault("trimReadsOverlap",   1,     "Minimum overlap between evidence to make contiguous trim; default '1'");
     setDefault("trimReadsCoverage",  1,     "Minimum depth of evidence to retain bases; default '1'");
+    setDefault("obtThreads",         undef, "Number of threads for trimReads and splitReads, which run on the canu host; default '1'");
 
     #$global{"splitReads..."}               = 1;
     #$synops{"splitReads..."}               = "";
@@ -908,6 +909,7 @@ sub setDefaults () {
     setDefault("cnsPartitions",   undef,       "Partition consensus into N jobs");
     setDefault("cnsPartitionMin", undef,       "Don't make a consensus partition with fewer than N reads");
     setDefault("cnsMaxCoverage",  40,          "Limit unitig consensus to at most this coverage; default '0' = unlimited");
+    setDefault("cnsWindowSize",   undef,       "Compute consensus for tigs longer than this in overlapping windows of this size; default 'undef' = whole tig");
     setDefault("cnsConsensus",    "pbdagcon",  "Which consensus algorithm to use; 'pbdagcon' (fast, reliable); 'utgcns' (multialignment output); 'quick' (single read mosaic); default 'pbdagcon'");
 
     #####  Correction Options
@@ -922,6 +924,7 @@ sub setDefaults () {
     setDefault("corMinCoverage",               undef,        "Minimum number of bases supporting each corrected base, if less than this sequences are split; default based on input read coverage: 0 <= 30x < 4 < 60x <= 4");
     setDefault("corFilter",                    "expensive",  "Method to filter short reads from correction; 'quick' or 'expensive'; default 'expensive'");
     setDefault("corConsensus",                 "falcon",     "Which consensus algorithm to use; only 'falcon' is supported; default 'falcon'");
+    setDefault("corLayoutStreaming",           0,            "Build correction layouts from overlaps as they are needed, instead of saving them in a corStore; default false");
 
     #  Convert all the keys to lowercase, and remember the case-sensitive version
 
@@ -1239,6 +1242,18 @@ sub checkParameters () {
         }
     }
 
+    #  Consensus windows overlap by min(10000, cnsWindowSize/4), so anything smaller than a few
+    #  kilobases is pointless.
+
+    if (defined(getGlobal("cnsWindowSize"))) {
+        if (getGlobal("cnsWindowSize") !~ m/^\d+$/) {
+            addCommandLineError("ERROR:  Invalid 'cnsWindowSize' specified (" . getGlobal("cnsWindowSize") . "); must be an integer\n");
+        }
+        elsif (getGlobal("cnsWindowSize") < 1000) {
+            addCommandLineError("ERROR:  Invalid 'cnsWindowSize' specified (" . getGlobal("cnsWindowSize") . "); must be at least 1000\n");
+        }
+    }
+
     #
     #  Check for invalid usage
     #
@@ -122,6 +122,11 @@ sub readErrorDetectionConfigure ($) {
 
     my $coverage = getExpectedCoverage("unitigging", $asm);
 
+    #  findErrors holds this many batches of overlapping reads in memory at once (BATCHES_IN_FLIGHT
+    #  in findErrors.H); while one is processed, the next ones are loaded.
+
+    my $batchesInFlight = 3;
+
     push @bgn, 1;
 
     for (my $id = 1; $id <= $maxID; $id++) {
@@ -130,9 +135,9 @@ sub readErrorDetectionConfigure ($) {
         $olaps += $numOlaps[$id];
 
         #  Guess how much extra memory used for overlapping reads.  Small genomes tend to load every read in the store,
-        #  large genomes ... load repeats + 2 * coverage * bases in reads (times 2 for overlaps off of each end)
+        #  large genomes ... load repeats + coverage * bases in reads for each batch in flight.
 
-        my $memory = (13 * $bases) + (12 * $olaps) + (2 * $bases * $coverage);
+        my $memory = (13 * $bases) + (12 * $olaps) + ($batchesInFlight * $bases * $coverage);
 
         if ((($maxMem   > 0) && ($memory >= $maxMem * 0.75)) ||    #  Allow 25% slop (10% is probably sufficient)
             (($maxReads > 0) && ($reads  >= $maxReads))      ||
@@ -145,7 +150,7 @@ sub readErrorDetectionConfigure ($) {
                    $memory / 1024 / 1024 / 1024, $reads,
                    13 * $bases / 1024 / 1024 / 1024, $bases,
                    12 * $olaps / 1024 / 1024 / 1024, $olaps,
-                   2 * $bases * $coverage / 1024 / 1024 / 1024);
+                   $batchesInFlight * $bases * $coverage / 1024 / 1024 / 1024);
 
             $nj++;
 
@@ -384,6 +389,7 @@ sub overlapErrorAdjustmentConfigure ($) {
     my $maxMem   = getGlobal("oeaMemory") * 1024 * 1024 * 1024;
     my $maxReads = getGlobal("oeaBatchSize");
     my $maxBases = getGlobal("oeaBatchLength");
+    my $nThreads = getGlobal("oeaThreads");
 
     print STDERR "\n";
     print STDERR "Configure OEA for ", getGlobal("oeaMemory"), "gb memory with batches of at most ", ($maxReads > 0) ? $maxReads : "(unlimited)", " reads and ", ($maxBases > 0) ? $maxBases : "(unlimited)", " bases.\n";
@@ -413,9 +419,9 @@ sub overlapErrorAdjustmentConfigure ($) {
         my $memAdj1   = (8   * $corrSize) * 0.33;    #  Overestimate of the size of the indel adjustments needed (total size includes mismatches)
         my $memReads  = (32  * $reads);              #  Read data in the batch
         my $memOlaps  = (32  * $olaps);              #  Loaded overlaps
-        my $memSeq    = (4   * 2097152);             #  two char arrays of 2*maxReadLen
-        my $memAdj2   = (16  * 2097152);             #  two Adjust_t arrays of maxReadLen
-        my $memWA     = (32  * 1048576);             #  Work area (16mb) and edit array (16mb)
+        my $memSeq    = (4   * 2097152) * $nThreads; #  two char arrays of 2*maxReadLen, per thread
+        my $memAdj2   = (16  * 2097152) * $nThreads; #  two Adjust_t arrays of maxReadLen, per thread
+        my $memWA     = (32  * 1048576) * $nThreads; #  Work area (16mb) and edit array (16mb), per thread
         my $memMisc   = (256 * 1048576);             #  Work area (16mb) and edit array (16mb) and (192mb) slop
 
         my $memory = $memBases + $memAdj1 + $memReads + $memOlaps + $memSeq + $memAdj2 + $memWA + $memMisc;
@@ -475,6 +481,25 @@ sub overlapErrorAdjustmentConfigure ($) {
 
     print STDERR "\n";
 
+    #  Unless the store lives in an object store (where each job works on its own copy), jobs
+    #  write their evalues directly into a shared file in the store, one range of reads each.
+
+    my $inPlace = !defined(getGlobal("objectStore"));
+
+    if ($inPlace) {
+        my $cmd;
+
+        $cmd  = "$bin/ovStoreBuild \\\n";
+        $cmd .= "  -G ../$asm.gkpStore \\\n";
+        $cmd .= "  -O ../$asm.ovlStore \\\n";
+        $cmd .= "  -evalues -create \\\n";
+        $cmd .= "> ./oea.create.err 2>&1";
+
+        if (runCommand($path, $cmd)) {
+            caExit("failed to create evalues update file in overlap store", "$path/oea.create.err");
+        }
+    }
+
     #  Dump a script
 
     open(F, "> $path/oea.sh") or caExit("can't open '$path/oea.sh' for writing: $!", undef);
@@ -512,9 +537,12 @@ sub overlapErrorAdjustmentConfigure ($) {
     print F "  -R \$minid \$maxid \\\n";
     print F "  -e " . getGlobal("utgOvlErrorRate") . " -l " . getGlobal("minOverlapLength") . " \\\n";
     print F "  -c ./red.red \\\n";
-    print F "  -o ./\$jobid.oea.WORKING \\\n";
+    print F "  -E \\\n"                                 if ( $inPlace);
+    print F "  -o ./\$jobid.oea.WORKING \\\n"           if (!$inPlace);
+    print F "  -t " . getGlobal("oeaThreads") . " \\\n";
     print F "&& \\\n";
-    print F "mv ./\$jobid.oea.WORKING ./\$jobid.oea\n";
+    print F "touch ./\$jobid.oea\n"                     if ( $inPlace);
+    print F "mv ./\$jobid.oea.WORKING ./\$jobid.oea\n"  if (!$inPlace);
     print F "\n";
     print F stashFileShellCode("$path", "\$jobid.oea", "");
     print F "\n";
@@ -655,11 +683,14 @@ sub updateOverlapStore ($) {
 
     fetchStore("unitigging/$asm.ovlStore");
 
+    #  If jobs updated evalues in place, just install them, otherwise load them from each job.
+
     $cmd  = "$bin/ovStoreBuild \\\n";
     $cmd .= "  -G ../$asm.gkpStore \\\n";
     $cmd .= "  -O ../$asm.ovlStore \\\n";
     $cmd .= "  -evalues \\\n";
-    $cmd .= "  -L ./oea.files \\\n";
+    $cmd .= "  -finish \\\n"          if ( -e "unitigging/$asm.ovlStore/evalues.WORKING");
+    $cmd .= "  -L ./oea.files \\\n"   if (! -e "unitigging/$asm.ovlStore/evalues.WORKING");
     $cmd .= "> ./oea.apply.err 2>&1";
 
     if (runCommand($path, $cmd)) {